@@ -15,4 +15,17 @@ global _get_EFLAGS
 _get_EFLAGS:
 	pushfd			; push eflags
 	pop	eax		; pop contents into eax
-	ret
\ No newline at end of file
+	ret
+
+; ----------------------------------------------------------------------
+; get_TSC()
+;
+; Returns the 64-bit time-stamp counter in edx:eax.
+;
+; ----------------------------------------------------------------------
+global _get_TSC
+; this function is exported.
+_get_TSC:
+	rdtsc			; edx:eax <- time-stamp counter
+	ret
+
@@ -15,4 +15,52 @@ global _get_EFLAGS
 _get_EFLAGS:
 	pushfd			; push eflags
 	pop	eax		; pop contents into eax
-	ret
\ No newline at end of file
+	ret
+
+; ----------------------------------------------------------------------
+; get_TSC()
+;
+; Returns the 64-bit time-stamp counter in edx:eax.
+;
+; ----------------------------------------------------------------------
+global _get_TSC
+; this function is exported.
+_get_TSC:
+	rdtsc			; edx:eax <- time-stamp counter
+	ret
+
+; ----------------------------------------------------------------------
+; port_insw(port, buf, n_words)
+;
+; Reads n_words 16-bit words from the I/O port into buf.
+;
+; ----------------------------------------------------------------------
+global _port_insw
+; this function is exported.
+_port_insw:
+	push	edi
+	movzx	edx, word [esp+8]	; port
+	mov	edi, [esp+12]		; destination buffer
+	mov	ecx, [esp+16]		; number of words
+	cld
+	rep	insw
+	pop	edi
+	ret
+
+; ----------------------------------------------------------------------
+; port_outsw(port, buf, n_words)
+;
+; Writes n_words 16-bit words from buf to the I/O port.
+;
+; ----------------------------------------------------------------------
+global _port_outsw
+; this function is exported.
+_port_outsw:
+	push	esi
+	movzx	edx, word [esp+8]	; port
+	mov	esi, [esp+12]		; source buffer
+	mov	ecx, [esp+16]		; number of words
+	cld
+	rep	outsw
+	pop	esi
+	ret